@@ -0,0 +1,81 @@
+//////////////////////////////////////////////////////////////////////
+// benchmark.h                                                      //
+// Goal:     micro-benchmarks for the GOUtil suite                  //
+//                                                                  //
+// This file is part of the GOUtil suite.                           //
+// GOUtil is free software: you can redistribute it and/or modify   //
+// it under the terms of the GNU General Public License as          //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// GOUtil is distributed in the hope that it will be useful,        //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with GOUtil.                                       //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+// CONSTANTS                                                        //
+//////////////////////////////////////////////////////////////////////
+
+const string USAGE = "\nUsage:\nbenchmark [-n NUM_TESTS] [-j NUM_THREADS] [-R REPEATS] [-r SEED] [-w WORK_DIR]\n"
+  "          [-T NUM_TERMS] [-d DEPTH] [-f FAN_IN] [-g GENES_PER_TERM] [-G NUM_GENES] [-P NUM_SIM_TERMS]\n";
+
+// size of the target set of the enrichment benchmark
+const unsigned int BENCH_TARGET_SIZE = 500;
+
+// number of genes, and of nearest neighbours of each of them, in the
+// gene similarity benchmark
+const unsigned int BENCH_GENE_LIST_SIZE = 100;
+const unsigned int BENCH_TOP_K = 10;
+
+// number of p-values corrected by the quadratic reference FDR, which
+// takes their square in comparisons
+const unsigned int MAX_QUADRATIC_FDR = 10000;
+
+// p-values below this are not checked against Boost, whose 1 - cdf
+// loses its precision to cancellation there
+const double MIN_CHECKED_PVALUE = 1e-4;
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES, STRUCTS, AND TYPEDEFS                                   //
+//////////////////////////////////////////////////////////////////////
+
+class Parameters {
+
+ public:
+  unsigned int numTests;
+  unsigned int numThreads;
+  unsigned int repeats;
+  unsigned int seed;
+  string workDir;
+
+  // shape of the synthetic ontology and annotations
+  unsigned int numTerms;
+  unsigned int depth;
+  unsigned int fanIn;
+  unsigned int genesPerTerm;
+  unsigned int numGenes;
+
+  // number of terms whose pairwise similarity is timed
+  unsigned int numSimTerms;
+
+  Parameters(char **, int);
+};
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+void benchFdr(Parameters &);
+void benchHypergeom(Parameters &);
+void benchPipeline(Parameters &, string, string, string);
+double elapsedSeconds(chrono::steady_clock::time_point);
+void generateOntology(Parameters &, string, string);
+unsigned int getCount(char **, int, string, unsigned int);
+void printTimes(string, vector<double> &, uint64_t, string);
+void quadraticFdr(vector<double> &, vector<double> &);
@@ -0,0 +1,94 @@
+#!/usr/bin/python
+
+######################################################################
+# binarySemSim.py                                                    #
+# Goal:    read the binary pairwise semantic similarity written by   #
+#          funSim -B f32|f64 [-c MIN_SCORE]. Shared by mdsSemSim.py  #
+#          and mdsSpectralCombo.py                                   #
+######################################################################
+
+from scipy.sparse import coo_matrix, issparse
+from scipy.spatial.distance import squareform
+import numpy
+
+######################################################################
+# CONSTANTS                                                          #
+######################################################################
+
+## layout of the header of the binary funSim output (see funSim.h)
+SEMSIM_MAGIC = b"GOSIMMAT"
+SEMSIM_HEADER = numpy.dtype([("magic", "S8"), ("version", "<u4"),
+                             ("valueSize", "<u4"), ("sparse", "<u4"),
+                             ("numTerms", "<u4"), ("nameWidth", "<u4"),
+                             ("indexType", "<u4"), ("numValues", "<u8"),
+                             ("namesOffset", "<u8"), ("dataOffset", "<u8"),
+                             ("reserved", "<u8")])
+
+######################################################################
+# FUNCTIONS                                                          #
+######################################################################
+
+def binaryDistMat(semSim):
+  """
+  turn the similarity returned by readBinarySemSim into a square
+  distance matrix, in the precision of the stored scores. Pairs
+  missing from a sparse output are assigned the maximum distance
+  """
+
+  if not issparse(semSim):
+    return squareform(1.0 - semSim, checks=False)
+
+  distMat = numpy.ones(semSim.shape, dtype=semSim.dtype)
+  distMat[semSim.row, semSim.col] = 1.0 - semSim.data
+  distMat[semSim.col, semSim.row] = 1.0 - semSim.data
+  numpy.fill_diagonal(distMat, 0.0)
+
+  return distMat
+
+######################################################################
+
+def isBinarySemSim(semSimFileName):
+  """
+  check whether the file is a binary funSim output
+  """
+
+  with open(semSimFileName, "rb") as semSimFile:
+    return semSimFile.read(len(SEMSIM_MAGIC)) == SEMSIM_MAGIC
+
+######################################################################
+
+def readBinarySemSim(semSimFileName):
+  """
+  memory-map a binary funSim output and return the similarity and the
+  list of terms. The similarity is the memory-mapped condensed matrix
+  (pairs i < j in row-major order), or, for the sparse output, a
+  scipy.sparse COO matrix holding the stored pairs (i < j) on top of
+  the mapped records, so no dense matrix is built
+  """
+
+  header = numpy.fromfile(semSimFileName, dtype=SEMSIM_HEADER, count=1)[0]
+  numTerms = int(header["numTerms"])
+  valueType = "<f4" if header["valueSize"] == 4 else "<f8"
+
+  ## read the term IDs
+  names = numpy.memmap(semSimFileName, mode="r",
+                       dtype="S%d" % header["nameWidth"],
+                       offset=int(header["namesOffset"]), shape=(numTerms,))
+  allGO = [name.decode() for name in names]
+
+  if header["sparse"] == 0:
+    ## the scores are stored as a condensed matrix
+    semSim = numpy.memmap(semSimFileName, mode="r", dtype=valueType,
+                          offset=int(header["dataOffset"]),
+                          shape=(int(header["numValues"]),))
+  else:
+    ## only the pairs above the cutoff are stored
+    records = numpy.memmap(semSimFileName, mode="r",
+                           dtype=[("i", "<u4"), ("j", "<u4"),
+                                  ("value", valueType)],
+                           offset=int(header["dataOffset"]),
+                           shape=(int(header["numValues"]),))
+    semSim = coo_matrix((records["value"], (records["i"], records["j"])),
+                        shape=(numTerms, numTerms))
+
+  return semSim, allGO
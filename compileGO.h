@@ -0,0 +1,33 @@
+//////////////////////////////////////////////////////////////////////
+// compileGO.h                                                      //
+// Goal:     compile an ontology and its annotations into a binary  //
+//           snapshot                                               //
+//                                                                  //
+// This file is part of the GOUtil suite.                           //
+// GOUtil is free software: you can redistribute it and/or modify   //
+// it under the terms of the GNU General Public License as          //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// GOUtil is distributed in the hope that it will be useful,        //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with GOUtil.                                       //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+// CONSTANTS                                                        //
+//////////////////////////////////////////////////////////////////////
+
+const string USAGE = "\nUsage:\ncompileGO -e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} -o SNAPSHOT\n"
+  "GAF_FILTERS: [-n P|F|C] [-x EVIDENCE1,EVIDENCE2,...] [-i id|symbol]\n";
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+void checkCommandLineArgs(char **, int);
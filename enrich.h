@@ -23,28 +23,38 @@
 // CONSTANTS                                                        //
 //////////////////////////////////////////////////////////////////////
 
-const string USAGE = "\nUsage:\nGOUtil -e EDGE_LIST -a ANNOTATIONS -b BACKGROUND -t TARGET -o OUTFILE -p FDR_THRESHOLD\n";
+const string USAGE = "\nUsage:\nGOUtil {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -b BACKGROUND -t TARGET -o OUTFILE -p FDR_THRESHOLD\n"
+  "GOUtil {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -b BACKGROUND -m MANIFEST -p FDR_THRESHOLD [-j NUM_THREADS]\n"
+  "GOUtil {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -b BACKGROUND -M TARGET_SETS -o OUTFILE_PREFIX -p FDR_THRESHOLD [-j NUM_THREADS]\n"
+  "GOUtil {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -b BACKGROUND -S [-u SOCKET] -p FDR_THRESHOLD [-j NUM_THREADS]\n"
+  "GAF_FILTERS: [-n P|F|C] [-x EVIDENCE1,EVIDENCE2,...] [-i id|symbol]\n"
+  "All modes accept --profile FILE to write a JSON report of the time, peak memory and items of each phase\n";
 
 //////////////////////////////////////////////////////////////////////
 // CLASSES, STRUCTS, AND TYPEDEFS                                   //
 //////////////////////////////////////////////////////////////////////
 
-class EnrichedTerms {
+class EnrichmentData {
 
  public:
-  vector<unsigned int> termIndex;
-  vector<string> termID;
-  vector<string> definition;
-  vector<double> pvalues;
-  vector<double> adjustedP;
-  vector<double> enrichFactor;
-  vector<unsigned int> sortedOrder;
-  unordered_map<unsigned int, set<string> > withTerm;
-
-  void addID(unordered_map<unsigned int, string>);
-  void fdrCorrection();
-  void printResults(string, double,
-		    unordered_map<unsigned int, string> &);
+  // ontology
+  Graph goG;
+  unordered_map<string, unsigned int> nodeHash;
+  unordered_map<unsigned int, string> revNodeHash;
+  unordered_map<unsigned int, string> definition;
+
+  // annotated genes, the terms annotated to the background genes, and
+  // the number of background genes annotated to each term or its
+  // descendants
+  unordered_map<string, unsigned int> geneHash;
+  vector<string> geneNames;
+  vector<vector<unsigned int> > geneCentric;
+  vector<bool> isInBack;
+  unsigned int backgroundSize;
+  vector<unsigned int> backgroundFreq;
+
+  // log(i!) up to the background size, for the hypergeometric test
+  vector<double> logFactorial;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -54,40 +64,50 @@ class Parameters {
  public:
   char *edgesFileName;
   string annotationsFileName;
+  GafOptions gaf;
+  string snapshotFileName;
   string backgroundSetFileName;
   string targetSetFileName;
   string outFileName;
+  string manifestFileName;
+  string setsFileName;
   double threshold;
+  unsigned int numThreads;
+  bool serve;
+  string socketPath;
 
   Parameters(char **, int);
 };
 
-typedef pair<unsigned int, double> intDouble;
+//////////////////////////////////////////////////////////////////////
+
+class TargetSet {
 
+ public:
+  string name;
+  string outFileName;
+  set<string> genes;
+};
 
 
 //////////////////////////////////////////////////////////////////////
 // PROTOTYPES                                                       //
 //////////////////////////////////////////////////////////////////////
 
-void calculateBackgroundFreq(vector<unsigned int> &,
-			     vector<unsigned int> &,
-			     vector<vector<string> >,
-                             vector<vector<string> >,
-			     Graph,
-			     unordered_map<unsigned int, set<string> > &);
 bool cmdOptionExists(char **, char **, const string &);
 char *getCmdOption(char **, char **, const string &);
-void doEnrichment(unsigned int, unsigned int, Graph,
-		  vector<vector<string> >, vector<vector<string> >,
-		  EnrichedTerms &);
+string enrichRequest(EnrichmentData &, const JsonValue &, double);
+bool enrichTarget(EnrichmentData &, set<string> &, string, double, string,
+		  unsigned int);
+void filterBackground(set<string> &, EnrichmentData &,
+		      vector<vector<unsigned int> > &,
+		      vector<vector<unsigned int> > &);
+void filterTarget(set<string> &, EnrichmentData &,
+		  vector<vector<unsigned int> > &);
 void findAllAncestors(set<unsigned int> &, set<unsigned int> &, Graph &);
+void readBatch(Parameters &, vector<TargetSet> &);
+bool runBatch(EnrichmentData &, vector<TargetSet> &, Parameters &);
 void storeSet(set<string> &, string);
-void storeTermCentricAnn(set<string> &,
-			 vector<vector<string> > &,
-			 vector<vector<string> > &, string,
-                         unordered_map<string, unsigned int>,
-			 set<string> &);
 
 
 
@@ -0,0 +1,84 @@
+//////////////////////////////////////////////////////////////////////
+// enrichStats.h                                                    //
+// Goal:     statistics for the enrichment analysis                 //
+//                                                                  //
+// This file is part of the GOUtil suite.                           //
+// GOUtil is free software: you can redistribute it and/or          //
+// modify it under the terms of the GNU General Public License as   //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// GOUtil is distributed in the hope that it will be useful,        //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with GOUtil.                                       //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+// CONSTANTS                                                        //
+//////////////////////////////////////////////////////////////////////
+
+// the tail sums stop when the terms become negligible
+const double TAIL_EPSILON = 1e-17;
+
+// minimum number of terms given to each thread
+const unsigned int MIN_TERMS_PER_THREAD = 1024;
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES AND TYPEDEFS                                             //
+//////////////////////////////////////////////////////////////////////
+
+class EnrichedTerms {
+
+ public:
+  vector<unsigned int> termIndex;
+  vector<string> termID;
+  vector<string> definition;
+  vector<double> pvalues;
+  vector<double> adjustedP;
+  vector<double> enrichFactor;
+  vector<unsigned int> sortedOrder;
+  unordered_map<unsigned int, vector<unsigned int> > withTerm;
+
+  void addID(unordered_map<unsigned int, string> &);
+  void fdrCorrection();
+  string jsonResults(double, unordered_map<unsigned int, string> &,
+		     vector<string> &);
+  void printResults(string, double,
+		    unordered_map<unsigned int, string> &,
+		    vector<string> &);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+typedef pair<unsigned int, double> intDouble;
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+void benjaminiHochberg(vector<double> &, vector<double> &,
+		       vector<unsigned int> &);
+void buildLogFactorial(vector<double> &, unsigned int);
+void calculateBackgroundFreq(vector<unsigned int> &,
+			     vector<vector<unsigned int> > &, Graph &);
+void calculateTargetFreq(vector<unsigned int> &,
+			 vector<vector<unsigned int> > &, Graph &,
+			 unordered_map<unsigned int,
+			 vector<unsigned int> > &);
+bool comparator2(const intDouble &, const intDouble &);
+void doEnrichment(unsigned int, unsigned int, Graph &,
+		  vector<unsigned int> &, vector<double> &,
+		  vector<vector<unsigned int> > &,
+		  EnrichedTerms &, unsigned int);
+double hypergeomLogPmf(vector<double> &, unsigned int, unsigned int,
+		       unsigned int, unsigned int);
+double hypergeomUpperTail(vector<double> &, unsigned int, unsigned int,
+			  unsigned int, unsigned int);
+void hypergeomUpperTails(vector<double> &, vector<unsigned int> &,
+			 vector<unsigned int> &, unsigned int, unsigned int,
+			 vector<double> &, unsigned int);
@@ -23,21 +23,31 @@
 // CONSTANTS                                                        //
 //////////////////////////////////////////////////////////////////////
 
-const string USAGE = "\nUsage:\nfunSim -e EDGE_LIST -a ANNOTATIONS -o OUTFILE -t INDEX_TYPE [-f ENRICH_OUTPUT]\n";
+const string USAGE = "\nUsage:\nfunSim {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -o OUTFILE -t INDEX_TYPE [-f ENRICH_OUTPUT] [-j NUM_THREADS] [-B f32|f64 [-c MIN_SCORE]]\n"
+  "funSim {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -t INDEX_TYPE -S [-u SOCKET] [-j NUM_THREADS]\n"
+  "funSim {-e EDGE_LIST {-a ANNOTATIONS | -g GAF [GAF_FILTERS]} | -s SNAPSHOT} -o OUTFILE -t INDEX_TYPE {-G GENE_LIST | -T GENE_SETS} [-m bma|max|avg] [-k TOP_K] [-j NUM_THREADS]\n"
+  "GAF_FILTERS: [-n P|F|C] [-x EVIDENCE1,EVIDENCE2,...] [-i id|symbol]\n"
+  "All modes accept --profile FILE to write a JSON report of the time, peak memory and items of each phase\n";
 
+// terms whose pairs are compared by one "terms" server request, which
+// bounds the time and the size of its response
+const unsigned int MAX_REQUEST_TERMS = 2000;
 
 //////////////////////////////////////////////////////////////////////
-// CLASSES                                                          //
+// CLASSES AND STRUCTS                                              //
 //////////////////////////////////////////////////////////////////////
 
-class Parameters {
+class Parameters : public SemSimOptions {
 
  public:
   char *edgesFileName;
   string annotationsFileName;
-  string outFileName;
+  GafOptions gaf;
+  string snapshotFileName;
   string enrichFileName;
   string indexType;
+  bool serve;
+  string socketPath;
 
   Parameters(char **, int);
 };
@@ -46,22 +56,18 @@ class Parameters {
 // PROTOTYPES                                                       //
 //////////////////////////////////////////////////////////////////////
 
-void calcAllSemSim(string, string, vector<double> &IC, Graph &,
-		   unordered_map<unsigned int, string> &);
-void calculateFreq(vector<unsigned int> &, vector<vector<string> > &,
-		   Graph );
+uint64_t calcAllSemSim(Parameters &, SemSimIndex &,
+		       unordered_map<unsigned int, string> &);
+void calculateFreq(vector<unsigned int> &,
+		   vector<vector<unsigned int> > &, Graph &);
 void calculateFreqTarget(vector<unsigned int> &,
 			 set<unsigned int> &,
-			 vector<vector<string> > &,
-			 Graph);
-void calculateIC(vector<double> &, vector<unsigned int> &,
-		 unsigned int);
+			 vector<vector<unsigned int> > &,
+			 Graph &);
+uint64_t calcTargetSemSim(set<unsigned int> &, Parameters &, SemSimIndex &,
+			  unordered_map<unsigned int, string> &);
 void checkCommandLineArgs(char **, int);
 void readEnrich(string,  unordered_map<string, unsigned int> &,
 		set<unsigned int> &);
-double semanticSim(vector<double> &, Graph &, unsigned int ,
-		   unsigned int, string);
-double semanticValue(set<unsigned int> &, vector<double> &);
-void storeTermCentricAnn(vector<vector<string> > &, string,
-                         unordered_map<string, unsigned int>,
-			 unsigned int &);
+string semSimRequest(SemSimIndex &, unordered_map<string, unsigned int> &,
+		     const JsonValue &);
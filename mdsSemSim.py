@@ -10,6 +10,7 @@
 #          scaling                                                   #
 #                                                                    #
 # Usage:   ./mdsSemSim.py SEMSIM_FILE OUTPUT_FILE                    #
+#          SEMSIM_FILE can be a text or a binary funSim output       #
 # Note:    This script requires a large amount of memory to run.     #
 #          The assumption is that the semantic similarity used is    #
 #          the Lin index.                                            #
@@ -20,12 +21,19 @@ from sklearn import manifold
 import numpy
 import sys
 
+from binarySemSim import binaryDistMat, isBinarySemSim, readBinarySemSim
+
 ######################################################################
 # FUNCTIONS                                                          #
 ######################################################################
 
 def getDistMat(semSimFileName):
 
+  ## binary output is memory-mapped directly
+  if isBinarySemSim(semSimFileName):
+    semSim, allGO = readBinarySemSim(semSimFileName)
+    return binaryDistMat(semSim), allGO
+
   ## store the distances into a dictionary
   semDistList = []
   semSimFile = open(semSimFileName, "r")
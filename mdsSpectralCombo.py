@@ -14,6 +14,8 @@ from scipy.spatial.distance import squareform
 from sklearn.cluster import SpectralClustering
 import sys
 
+from binarySemSim import binaryDistMat, isBinarySemSim, readBinarySemSim
+
 ######################################################################
 # CONSTANTS                                                          #
 ######################################################################
@@ -29,27 +31,12 @@ def doMDS(semDistFileName):
   perform MDS on the distance matrix
   """
 
-  ## store the distances into a dictionary
-  semDistList = []
-  semSimFile = open(semSimFileName, "r")
-  allGO = []
-  go1 = ""
-  go2 = ""
-  previousGO = ""
-  for line in semSimFile:
-    go1, go2, semSim = line[:-1].split()
-    if previousGO != go1:
-      allGO.append(go1)
-    previousGO = go1
-    
-    semDist = 1.0 - float(semSim)
-    semDistList.append(semDist)
-
-  semSimFile.close()
-  allGO.append(go2)
-
-  ## build a distance matrix
-  semDistMat = squareform(semDistList)  
+  ## binary output is memory-mapped directly
+  if isBinarySemSim(semSimFileName):
+    semSim, allGO = readBinarySemSim(semSimFileName)
+    semDistMat = binaryDistMat(semSim)
+  else:
+    semDistMat, allGO = getDistMat(semSimFileName)
   
   ## perform MDS
   seed = numpy.random.RandomState(seed=1)
@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////
+// semSim.h                                                         //
+// Goal:     information content, semantic similarity between       //
+//           pairs of terms, and the similarity matrices of terms   //
+//           and genes                                              //
+//                                                                  //
+// This file is part of the GOUtil suite.                           //
+// GOUtil is free software: you can redistribute it and/or modify   //
+// it under the terms of the GNU General Public License as          //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// GOUtil is distributed in the hope that it will be useful,        //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with GOUtil.                                       //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+// CONSTANTS                                                        //
+//////////////////////////////////////////////////////////////////////
+
+enum IndexType {LIN, RESNIK, AIC};
+
+// number of rows computed by a thread in one go, and number of
+// columns visited together within those rows
+const unsigned int ROW_BLOCK = 32;
+const unsigned int COL_TILE = 512;
+
+// bytes of results held in memory, computed but not yet written, by
+// the threads of the pairwise similarity
+const uint64_t MAX_BUFFERED_BYTES = 256 << 20;
+
+enum Aggregation {BMA, MAX, AVG};
+enum OutputFormat {TEXT, FLOAT32, FLOAT64};
+
+// binary similarity matrix files start with this magic string
+const char SEMSIM_MAGIC[] = "GOSIMMAT";
+const uint32_t SEMSIM_VERSION = 1;
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+class SemSimIndex {
+
+ public:
+  IndexType indexType;
+  vector<double> &IC;
+  AncestorIndex &ancIndex;
+
+  // for Lin and Resnik, the ancestors of each term are stored as ranks
+  // by decreasing IC, so that the first common ancestor is the MICA
+  vector<unsigned int> rankOffset;
+  vector<unsigned int> rankedAnc;
+  vector<double> rankedIC;
+
+  // for AIC, the weight of each term and the semantic value of its
+  // ancestors
+  vector<double> sw;
+  vector<double> sv;
+
+  SemSimIndex(AncestorIndex &, vector<double> &, string);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// options of the pairwise and gene similarity output
+class SemSimOptions {
+
+ public:
+  string outFileName;
+  OutputFormat outFormat;
+  bool sparse;
+  double minScore;
+  unsigned int numThreads;
+  string geneListFileName;
+  string geneSetsFileName;
+  Aggregation aggregation;
+  unsigned int topK;
+
+  SemSimOptions();
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// header of the binary similarity matrix (64 bytes, little-endian).
+// It is followed by numTerms term IDs of nameWidth bytes each
+// (null-padded) at namesOffset, and by the scores at dataOffset: the
+// condensed upper triangle in row-major order (pairs i < j), or, for
+// the sparse variant, numValues (uint32 i, uint32 j, score) records
+struct SemSimHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t valueSize;
+  uint32_t sparse;
+  uint32_t numTerms;
+  uint32_t nameWidth;
+  uint32_t indexType;
+  uint64_t numValues;
+  uint64_t namesOffset;
+  uint64_t dataOffset;
+  uint64_t reserved;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// a gene or a gene set, with its informative terms (IC > 0). The
+// terms are stored as positions in the term similarity cache
+class TermGroup {
+
+ public:
+  string name;
+  vector<unsigned int> terms;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// similarity between the distinct terms of the queried genes (or gene
+// sets) and the distinct terms of all the compared ones, stored in
+// single precision with one contiguous row per query term. The query
+// terms come first, so that their rows are indexed by their position,
+// and the similarity of the other terms with them is read from the
+// same rows since it is symmetric
+class TermSimCache {
+
+ public:
+  unsigned int numRows;
+  unsigned int numTerms;
+  vector<float> scores;
+
+  TermSimCache(SemSimIndex &, vector<TermGroup> &, vector<unsigned int> &,
+	       unsigned int);
+  const float *row(unsigned int i) const {
+    return scores.data() + (size_t)i * numTerms;
+  }
+};
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+double aggregateSim(const TermSimCache &, const vector<unsigned int> &,
+		    const vector<unsigned int> &, Aggregation);
+uint64_t calcGroupSemSim(SemSimOptions &, SemSimIndex &,
+			 vector<vector<unsigned int> > &, vector<string> &,
+			 unordered_map<string, unsigned int> &);
+uint64_t calcPairSemSim(vector<unsigned int> &, SemSimOptions &,
+			SemSimIndex &, unordered_map<unsigned int, string> &,
+			bool);
+void calculateIC(vector<double> &, vector<unsigned int> &,
+		 unsigned int);
+void computeInOrder(unsigned int, unsigned int,
+		    function<uint64_t(unsigned int)>,
+		    function<string(unsigned int)>,
+		    function<void(unsigned int, string &)>);
+string groupSimBlock(vector<TermGroup> &, unsigned int, unsigned int,
+		     TermSimCache &, Aggregation);
+double semanticSim(SemSimIndex &, unsigned int, unsigned int);
+string semSimBlock(vector<unsigned int> &, unsigned int, unsigned int,
+		   SemSimIndex &, vector<string> &, SemSimOptions &);
+string topGroupSim(vector<TermGroup> &, unsigned int, TermSimCache &,
+		   Aggregation, unsigned int);
+void writeSemSimHeader(fstream &, SemSimOptions &, SemSimIndex &,
+		       vector<string> &, uint64_t);
@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////
+// server.h                                                         //
+// Goal:     resident query server shared by enrich and funSim      //
+//                                                                  //
+// This file is part of the GOUtil suite.                           //
+// GOUtil is free software: you can redistribute it and/or modify   //
+// it under the terms of the GNU General Public License as          //
+// published by the Free Software Foundation, either version 3 of   //
+// the License, or (at your option) any later version.              //
+//                                                                  //
+// GOUtil is distributed in the hope that it will be useful,        //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of   //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the    //
+// GNU General Public License for more details.                     //
+//                                                                  //
+// You should have received a copy of the GNU General Public        //
+// License along with GOUtil.                                       //
+// If not, see <http://www.gnu.org/licenses/>.                      //
+//////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////
+// CONSTANTS                                                        //
+//////////////////////////////////////////////////////////////////////
+
+// number of most recent requests used for the latency percentiles
+const unsigned int LATENCY_WINDOW = 100000;
+
+// size of the buffer used to read requests from a socket
+const unsigned int READ_BUFFER_SIZE = 65536;
+
+// longest accepted request line; clients sending longer ones get an
+// error and, on a socket, are disconnected
+const unsigned int MAX_REQUEST_SIZE = 16 << 20;
+
+// clients connected to the socket at the same time, each with its
+// own reading thread and buffer
+const unsigned int MAX_CONNECTIONS = 64;
+
+// deepest nesting of arrays and objects accepted in a request
+const unsigned int MAX_JSON_DEPTH = 64;
+
+// requests waiting for a thread of the pool; readers block when the
+// queue is full, which pushes back on the clients
+const unsigned int MAX_QUEUED_TASKS = 1024;
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+// a parsed JSON value. Requests are small, so values are stored in
+// plain containers
+class JsonValue {
+
+ public:
+  enum Type {JSON_NULL, JSON_BOOL, JSON_NUMBER, JSON_STRING, JSON_ARRAY,
+	     JSON_OBJECT};
+
+  Type type;
+  bool boolean;
+  double number;
+  string str;
+  vector<JsonValue> items;
+  map<string, JsonValue> members;
+
+  JsonValue();
+  const JsonValue *find(const string &) const;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// latency counters of the served requests, updated concurrently by
+// the threads of the pool
+class LatencyStats {
+
+ public:
+  uint64_t numRequests;
+  uint64_t numErrors;
+  vector<double> window;
+  mutex lock;
+
+  LatencyStats();
+  void add(double, bool);
+  string report();
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// client connected to the Unix domain socket. It is shared by the
+// thread reading its requests and by the pending tasks answering
+// them, and closed when the last of them is done
+class Connection {
+
+ public:
+  int fd;
+  mutex lock;
+
+  Connection(int);
+  ~Connection();
+  void send(const string &);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// fixed pool of threads running the queued tasks in order of arrival.
+// At most MAX_QUEUED_TASKS tasks wait in the queue
+class ThreadPool {
+
+ public:
+  vector<thread> workers;
+  queue<function<void()> > tasks;
+  mutex lock;
+  condition_variable hasTask;
+  condition_variable hasRoom;
+  condition_variable isIdle;
+  unsigned int numBusy;
+  bool stopping;
+
+  ThreadPool(unsigned int);
+  ~ThreadPool();
+  void submit(function<void()>);
+  void wait();
+};
+
+// the handler turns a request into the members of the response
+// object (without the braces), and throws runtime_error on bad
+// requests
+typedef function<string(const JsonValue &)> RequestHandler;
+
+//////////////////////////////////////////////////////////////////////
+// PROTOTYPES                                                       //
+//////////////////////////////////////////////////////////////////////
+
+string answerRequest(const string &, RequestHandler &, LatencyStats &,
+		     chrono::steady_clock::time_point);
+string jsonNumber(double);
+string jsonString(const string &);
+void parseJson(const string &, JsonValue &);
+unsigned int parseJsonValue(const string &, unsigned int, JsonValue &,
+			    unsigned int);
+const JsonValue &requireMember(const JsonValue &, const string &,
+			       JsonValue::Type);
+void runServer(string, unsigned int, RequestHandler);
+void serveSocket(string, ThreadPool &, RequestHandler &, LatencyStats &);
+void serveConnection(shared_ptr<Connection>, ThreadPool &, RequestHandler &,
+		     LatencyStats &);
+void serveStdin(ThreadPool &, RequestHandler &, LatencyStats &);
+unsigned int skipSpaces(const string &, unsigned int);
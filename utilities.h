@@ -21,12 +21,151 @@
 
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <unordered_map>
 
 typedef boost::adjacency_list<boost::vecS, boost::vecS,
 			      boost::bidirectionalS> Graph;
 
 
+//////////////////////////////////////////////////////////////////////
+// CONSTANTS                                                        //
+//////////////////////////////////////////////////////////////////////
+
+// compiled ontology/annotation snapshots start with this magic string
+const char SNAPSHOT_MAGIC[] = "GOUTILSS";
+const uint32_t SNAPSHOT_VERSION = 1;
+
+// largest number of threads accepted with -j
+const unsigned int MAX_THREADS = 256;
+
+// compressed files are inflated in chunks of this size
+const unsigned int INFLATE_CHUNK = 1 << 20;
+
+// columns of a GO annotation (GAF) file
+const unsigned int GAF_ID = 1;
+const unsigned int GAF_SYMBOL = 2;
+const unsigned int GAF_QUALIFIER = 3;
+const unsigned int GAF_TERM = 4;
+const unsigned int GAF_EVIDENCE = 6;
+const unsigned int GAF_ASPECT = 8;
+
+//////////////////////////////////////////////////////////////////////
+// CLASSES                                                          //
+//////////////////////////////////////////////////////////////////////
+
+class AncestorIndex {
+
+ public:
+  // ancestors of term i (i included), sorted by term index, are
+  // stored in ancestors[offset[i]] ... ancestors[offset[i + 1] - 1]
+  vector<unsigned int> offset;
+  vector<unsigned int> ancestors;
+
+  AncestorIndex(Graph &);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// annotations read directly from a GO annotation (GAF) file, possibly
+// gzip-compressed, instead of the GENE TERM1 TERM2 ... format.
+// Negated annotations are always skipped
+class GafOptions {
+
+ public:
+  bool isGaf;
+  string aspect; // P, F, or C (all of them if empty)
+  set<string> excludedEvidence;
+  bool useSymbol; // gene symbol (column 3) or database ID (column 2)
+
+  GafOptions();
+  GafOptions(char **, int);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// read-only memory mapping of a whole file
+class MappedFile {
+
+ public:
+  const char *data;
+  uint64_t size;
+
+  MappedFile(string);
+  ~MappedFile();
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// wall time, peak resident memory and number of processed items of
+// each phase of a run, written as a JSON report when the run is
+// started with --profile FILE
+class Profiler {
+
+ public:
+  string fileName;
+  chrono::steady_clock::time_point start;
+  chrono::steady_clock::time_point last;
+  vector<string> names;
+  vector<double> seconds;
+  vector<long> peakRss;
+  vector<uint64_t> items;
+
+  Profiler(char **, int);
+  bool isEnabled() const {
+    return !fileName.empty();
+  }
+  void phase(string, uint64_t);
+  void write(string);
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// header of a compiled snapshot (little-endian). All the sections
+// start at 8-byte aligned offsets; string tables hold a uint64 count,
+// count + 1 uint64 offsets relative to the first character, and the
+// characters. The parents of term i are parents[parentOffset[i]] ...
+// parents[parentOffset[i + 1] - 1] (uint64 offsets, uint32 indices),
+// and its genes are stored in the same way in postings
+struct SnapshotHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t numTerms;
+  uint32_t numGenes;
+  uint32_t reserved;
+  uint64_t numEdges;
+  uint64_t numPostings;
+
+  // size, modification time (in nanoseconds) and FNV-1a hash of the
+  // source files
+  uint64_t edgesSize;
+  uint64_t edgesTime;
+  uint64_t edgesHash;
+  uint64_t annSize;
+  uint64_t annTime;
+  uint64_t annHash;
+
+  // section offsets
+  uint64_t sourcesOffset;
+  uint64_t termsOffset;
+  uint64_t definitionsOffset;
+  uint64_t parentOffsetOffset;
+  uint64_t parentsOffset;
+  uint64_t genesOffset;
+  uint64_t postingOffsetOffset;
+  uint64_t postingsOffset;
+  uint64_t fileSize;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// a token is a range of characters of a mapped or inflated buffer,
+// and lines are passed to the handler as ranges too
+typedef pair<const char *, const char *> Token;
+typedef function<void(const char *, const char *)> LineHandler;
+
 //////////////////////////////////////////////////////////////////////
 // PROTOTYPES                                                       //
 //////////////////////////////////////////////////////////////////////
@@ -34,10 +173,43 @@ typedef boost::adjacency_list<boost::vecS, boost::vecS,
 void buildGraph(Graph &, unordered_map<string, unsigned int> &, string);
 void buildHashTable(string, unordered_map<string, unsigned int> &,
 		    unordered_map<unsigned int, string> &,
-		    unordered_map<unsigned int, string> &);
+		    unordered_map<unsigned int, string> &, bool);
+void appendStringTable(string &, vector<string> &);
 bool cmdOptionExists(char **, char **, const std::string &);
+uint64_t countAnnotations(vector<vector<unsigned int> > &);
+void checkSnapshotCsr(string, const uint64_t *, unsigned int,
+		      const uint32_t *, uint64_t, unsigned int);
+void checkSnapshotSection(string, uint64_t, uint64_t, uint64_t);
+void checkSnapshotSource(string, uint64_t, uint64_t, uint64_t, string);
 void findAllAncestors(set<unsigned int> &,
 		      set<unsigned int> &, Graph &);
-void findChildren(unsigned int, set<unsigned int> &, Graph &);
 char *getCmdOption(char **, char **, const std::string &);
 unordered_map<string, unsigned int> getNodeHash(set<string>);
+unsigned int getNumThreads(char **, int);
+uint64_t hashFile(string, uint64_t &, uint64_t &);
+void loadSnapshot(string, unordered_map<string, unsigned int> &,
+		  unordered_map<unsigned int, string> &,
+		  unordered_map<unsigned int, string> &, Graph &,
+		  vector<vector<unsigned int> > &,
+		  unordered_map<string, unsigned int> &, vector<string> &);
+uint64_t modificationTime(const struct stat &);
+long peakRssKb();
+const char *processLines(const char *, const char *, LineHandler &);
+void propagateAnnotations(Graph &, vector<vector<unsigned int> > &,
+			  vector<vector<unsigned int> > &);
+void sortGeneIDs(unordered_map<string, unsigned int> &, vector<string> &,
+		 vector<vector<unsigned int> > &);
+void readLines(string, LineHandler, bool);
+void readStringTable(string, const char *, uint64_t, uint64_t,
+		     vector<string> &);
+unsigned int splitFields(const char *, const char *, char, vector<Token> &);
+unsigned int splitTokens(const char *, const char *, vector<Token> &);
+void storeTermCentricAnn(vector<vector<unsigned int> > &, string,
+			 GafOptions &, unordered_map<string, unsigned int> &,
+			 unordered_map<string, unsigned int> &,
+			 vector<string> &, bool);
+void topologicalOrder(Graph &, vector<unsigned int> &);
+void writeSnapshot(string, string, string,
+		   unordered_map<unsigned int, string> &,
+		   unordered_map<unsigned int, string> &, Graph &,
+		   vector<vector<unsigned int> > &, vector<string> &);